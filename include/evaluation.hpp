@@ -17,7 +17,9 @@ std::vector<Detection> loadDetectionsFromCSV(const std::string &csvPath);
 
 double computeIoU(const cv::Rect &pred, const cv::Rect &truth);
 
-void evaluateFaceDetection(const std::string &predCsv, const std::string &gtCsv, const std::string &tpCsvOutput,
-                           double iouThreshold = 0.5);
+double evaluateFaceDetection(const std::string &predCsv, const std::string &gtCsv, const std::string &tpCsvOutput,
+                             double iouThreshold = 0.5, bool printReport = true);
+
+void evaluateCandidateCoverage(const std::string &candidatesCsv, const std::string &gtCsv);
 
 #endif
@@ -29,6 +29,11 @@ std::vector<cv::Rect> detectRotatedFaces(const cv::Mat &gray,
 
 std::vector<cv::Rect> mergeOverlappingBoxes(const std::vector<cv::Rect> &boxes, float iouThreshold);
 
+std::vector<cv::Rect> findCandidateRegions(const cv::Mat &img,
+                                          const cv::Mat &gray,
+                                          const cv::Size &minSize,
+                                          double threshold);
+
 bool isValidFace(const cv::Rect &face, const cv::Mat &grayImage);
 
 void drawAndSaveDetections(const std::string &inputFile,
@@ -37,10 +42,12 @@ void drawAndSaveDetections(const std::string &inputFile,
                            const cv::Mat &image,
                            std::ofstream &csv);
 
-void processImage(const std::string &file,
-                  const std::string &outputFolder,
-                  cv::CascadeClassifier &frontalCascade,
-                  cv::CascadeClassifier &profileCascade,
-                  std::ofstream &csv);
+double processImage(const std::string &file,
+                    const std::string &outputFolder,
+                    cv::CascadeClassifier &frontalCascade,
+                    cv::CascadeClassifier &profileCascade,
+                    std::ofstream &csv,
+                    std::ofstream &candidatesCsv,
+                    double candidateThreshold);
 
 #endif
@@ -73,9 +73,9 @@ double computeIoU(const cv::Rect &pred, const cv::Rect &truth) {
     return unionArea > 0 ? static_cast<double>(interArea) / unionArea : 0.0;
 }
 
-// Evaluate face detection by comparing predictions with ground truth
-void evaluateFaceDetection(const std::string &predCsv, const std::string &gtCsv, const std::string &tpCsvOutput,
-                           double iouThreshold) {
+// Evaluate face detection by comparing predictions with ground truth, returns the recall
+double evaluateFaceDetection(const std::string &predCsv, const std::string &gtCsv, const std::string &tpCsvOutput,
+                             double iouThreshold, bool printReport) {
     auto predictions = loadDetectionsFromCSV(predCsv);
     auto gts = loadDetectionsFromCSV(gtCsv);
 
@@ -171,11 +171,45 @@ void evaluateFaceDetection(const std::string &predCsv, const std::string &gtCsv,
     double recall = TP + FN > 0 ? static_cast<double>(TP) / (TP + FN) : 0.0;
     double f1 = precision + recall > 0 ? 2 * (precision * recall) / (precision + recall) : 0.0;
 
-    std::cout << "\nFace Detection Evaluation\n";
-    std::cout << "True Positives: " << TP << "\n";
-    std::cout << "False Positives: " << FP << "\n";
-    std::cout << "False Negatives: " << FN << "\n";
-    std::cout << "Precision: " << precision << "\n";
-    std::cout << "Recall:    " << recall << "\n";
-    std::cout << "F1-Score:  " << f1 << "\n";
+    if (printReport) {
+        std::cout << "\nFace Detection Evaluation\n";
+        std::cout << "True Positives: " << TP << "\n";
+        std::cout << "False Positives: " << FP << "\n";
+        std::cout << "False Negatives: " << FN << "\n";
+        std::cout << "Precision: " << precision << "\n";
+        std::cout << "Recall:    " << recall << "\n";
+        std::cout << "F1-Score:  " << f1 << "\n";
+    }
+
+    return recall;
+}
+
+// Report how many ground truth faces fall entirely inside the candidate regions.
+// This is coverage only: a covered face can still be missed by the cascades.
+void evaluateCandidateCoverage(const std::string &candidatesCsv, const std::string &gtCsv) {
+    auto candidates = loadDetectionsFromCSV(candidatesCsv);
+    auto gts = loadDetectionsFromCSV(gtCsv);
+
+    std::unordered_map<std::string, std::vector<cv::Rect> > candidateMap;
+    for (const auto &c: candidates)
+        candidateMap[c.imageName].push_back(c.bbox);
+
+    int covered = 0;
+    for (const auto &gt: gts) {
+        for (const auto &roi: candidateMap[gt.imageName]) {
+            // The cascades only see pixels inside the region
+            if ((gt.bbox & roi) == gt.bbox) {
+                covered++;
+                break;
+            }
+        }
+    }
+
+    int total = static_cast<int>(gts.size());
+    double coverage = total > 0 ? static_cast<double>(covered) / total : 0.0;
+
+    std::cout << "\nCandidate Region Coverage\n";
+    std::cout << "Faces covered: " << covered << "/" << total << "\n";
+    std::cout << "Coverage:      " << coverage << "\n";
+    std::cout << "Coverage loss: " << 1.0 - coverage << "\n";
 }
@@ -145,6 +145,111 @@ std::vector<cv::Rect> mergeOverlappingBoxes(const std::vector<cv::Rect> &boxes,
     return merged;
 }
 
+std::vector<cv::Rect> findCandidateRegions(const cv::Mat &img,
+                                          const cv::Mat &gray,
+                                          const cv::Size &minSize,
+                                          double threshold) {
+    const cv::Rect frame(0, 0, gray.cols, gray.rows);
+    if (threshold <= 0.0)
+        return {frame};
+
+    // Skin-tone mask on the color frame (YCrCb)
+    cv::Mat ycrcb, skin;
+    cv::cvtColor(img, ycrcb, cv::COLOR_BGR2YCrCb);
+    cv::inRange(ycrcb, cv::Scalar(0, 133, 77), cv::Scalar(255, 173, 127), skin);
+
+    // Grayscale photos carry no chroma, so fall back to texture only
+    std::vector<cv::Mat> channels;
+    cv::split(ycrcb, channels);
+    cv::Scalar crMean, crStd, cbMean, cbStd;
+    cv::meanStdDev(channels[1], crMean, crStd);
+    cv::meanStdDev(channels[2], cbMean, cbStd);
+    bool hasColor = crStd[0] > 2.0 || cbStd[0] > 2.0;
+
+    // Integral images for constant-time sums over each cell
+    cv::Mat skinSum, graySum, graySqSum;
+    cv::integral(skin / 255, skinSum, CV_32S);
+    cv::integral(gray, graySum, graySqSum, CV_64F, CV_64F);
+
+    // Score a grid of cells small enough that every face covers at least one
+    int cell = std::max(8, std::min(minSize.width, minSize.height) / 2);
+    int gridCols = (gray.cols + cell - 1) / cell;
+    int gridRows = (gray.rows + cell - 1) / cell;
+    cv::Mat grid = cv::Mat::zeros(gridRows, gridCols, CV_8U);
+
+    for (int gy = 0; gy < gridRows; ++gy) {
+        for (int gx = 0; gx < gridCols; ++gx) {
+            cv::Rect c = cv::Rect(gx * cell, gy * cell, cell, cell) & frame;
+            int x0 = c.x, y0 = c.y, x1 = c.x + c.width, y1 = c.y + c.height;
+            double n = c.area();
+
+            double skinFrac = (skinSum.at<int>(y1, x1) - skinSum.at<int>(y0, x1) -
+                               skinSum.at<int>(y1, x0) + skinSum.at<int>(y0, x0)) / n;
+            double sum = graySum.at<double>(y1, x1) - graySum.at<double>(y0, x1) -
+                         graySum.at<double>(y1, x0) + graySum.at<double>(y0, x0);
+            double sqSum = graySqSum.at<double>(y1, x1) - graySqSum.at<double>(y0, x1) -
+                           graySqSum.at<double>(y1, x0) + graySqSum.at<double>(y0, x0);
+            double mean = sum / n;
+            double variance = std::max(0.0, sqSum / n - mean * mean);
+
+            // Flat areas (sky, walls) have almost no texture
+            double texture = std::min(std::sqrt(variance) / 32.0, 1.0);
+            double score = hasColor ? 0.5 * (skinFrac + texture) : texture;
+
+            if (score >= threshold)
+                grid.at<uchar>(gy, gx) = 255;
+        }
+    }
+
+    // Bounding boxes of the candidate blobs, padded so faces are not cut at the border.
+    // A face rotated by 45 degrees maps back to a box ~21% of its size larger on each side,
+    // and a face can be as large as the blob, so the padding grows with the blob.
+    std::vector<std::vector<cv::Point> > contours;
+    cv::findContours(grid, contours, cv::RETR_EXTERNAL, cv::CHAIN_APPROX_SIMPLE);
+
+    std::vector<cv::Rect> regions;
+    for (const auto &contour: contours) {
+        cv::Rect r = cv::boundingRect(contour);
+        cv::Rect blob(r.x * cell, r.y * cell, r.width * cell, r.height * cell);
+        int pad = std::max({minSize.width, minSize.height,
+                            static_cast<int>(std::ceil(0.25 * std::max(blob.width, blob.height)))});
+        cv::Rect roi(blob.x - pad, blob.y - pad, blob.width + 2 * pad, blob.height + 2 * pad);
+        regions.push_back(roi & frame);
+    }
+
+    // Merge overlapping regions so no area is scanned twice
+    bool mergedAny = true;
+    while (mergedAny) {
+        mergedAny = false;
+        for (size_t i = 0; i < regions.size() && !mergedAny; ++i) {
+            for (size_t j = i + 1; j < regions.size(); ++j) {
+                if ((regions[i] & regions[j]).area() > 0) {
+                    regions[i] |= regions[j];
+                    regions.erase(regions.begin() + static_cast<long>(j));
+                    mergedAny = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    // Drop regions too small to hold a detection
+    std::vector<cv::Rect> candidates;
+    double candidateArea = 0.0;
+    for (const auto &roi: regions) {
+        if (roi.width >= minSize.width && roi.height >= minSize.height) {
+            candidates.push_back(roi);
+            candidateArea += roi.area();
+        }
+    }
+
+    // Not worth cropping when most of the frame is a candidate anyway
+    if (candidateArea >= 0.8 * frame.area())
+        return {frame};
+
+    return candidates;
+}
+
 bool isValidFace(const cv::Rect &face, const cv::Mat &grayImage) {
     int imgW = grayImage.cols;
     int imgH = grayImage.rows;
@@ -175,15 +280,17 @@ void drawAndSaveDetections(const std::string &inputFile,
     cv::imwrite(outputPath, annotated);
 }
 
-void processImage(const std::string &file,
-                  const std::string &outputFolder,
-                  cv::CascadeClassifier &frontalCascade,
-                  cv::CascadeClassifier &profileCascade,
-                  std::ofstream &csv) {
+double processImage(const std::string &file,
+                    const std::string &outputFolder,
+                    cv::CascadeClassifier &frontalCascade,
+                    cv::CascadeClassifier &profileCascade,
+                    std::ofstream &csv,
+                    std::ofstream &candidatesCsv,
+                    double candidateThreshold) {
     cv::Mat img = cv::imread(file);
     if (img.empty()) {
         std::cerr << "Error loading image: " << file << std::endl;
-        return;
+        return -1.0;
     }
 
     int minDim = std::min(img.cols, img.rows);
@@ -194,14 +301,30 @@ void processImage(const std::string &file,
 
     cv::Mat gray = preprocessImage(img);
 
-    auto frontal = detectFrontalFaces(gray, frontalCascade, scaleFactor, minNeighbors, minSize);
-    auto profile = detectProfileFaces(gray, profileCascade, scaleFactor, minNeighbors, minSize);
-    auto rotated = detectRotatedFaces(gray, frontalCascade, scaleFactor, minNeighbors, minSize, rotationAngles);
+    // Restrict the cascades to regions that may contain a face
+    auto candidates = findCandidateRegions(img, gray, minSize, candidateThreshold);
+    std::string imageName = file.substr(file.find_last_of("/\\") + 1);
 
-    frontal.insert(frontal.end(), profile.begin(), profile.end());
-    frontal.insert(frontal.end(), rotated.begin(), rotated.end());
+    std::vector<cv::Rect> detections;
+    double searchedArea = 0.0;
+    for (const auto &roi: candidates) {
+        cv::Mat roiGray = gray(roi);
 
-    auto merged = mergeOverlappingBoxes(frontal, 0.3f);
+        auto frontal = detectFrontalFaces(roiGray, frontalCascade, scaleFactor, minNeighbors, minSize);
+        auto profile = detectProfileFaces(roiGray, profileCascade, scaleFactor, minNeighbors, minSize);
+        auto rotated = detectRotatedFaces(roiGray, frontalCascade, scaleFactor, minNeighbors, minSize,
+                                          rotationAngles);
+
+        // Map boxes back to full-frame coordinates
+        for (const auto &r: frontal) detections.push_back(r + roi.tl());
+        for (const auto &r: profile) detections.push_back(r + roi.tl());
+        for (const auto &r: rotated) detections.push_back(r + roi.tl());
+
+        candidatesCsv << imageName << "," << roi.x << "," << roi.y << "," << roi.width << "," << roi.height << "\n";
+        searchedArea += roi.area();
+    }
+
+    auto merged = mergeOverlappingBoxes(detections, 0.3f);
 
     std::vector<cv::Rect> finalFaces;
     for (const auto &face: merged) {
@@ -210,4 +333,7 @@ void processImage(const std::string &file,
     }
 
     drawAndSaveDetections(file, outputFolder, finalFaces, img, csv);
+
+    // Fraction of the frame handed to the cascades (-1 when the image fails to load)
+    return searchedArea / (static_cast<double>(gray.cols) * gray.rows);
 }
@@ -3,6 +3,7 @@
 #include <iostream>
 #include <filesystem>
 #include <fstream>
+#include <unordered_set>
 #include "utils.hpp"
 #include "face_detector.hpp"
 #include "evaluation.hpp"
@@ -22,12 +23,31 @@ int main(int argc, char* argv[]) {
             inputRoot += '/';
     }
 
+    // Candidate region threshold: 0 disables the prefilter and scans the full frame
+    double candidateThreshold = 0.35;
+    if (argc > 2) {
+        std::string arg = argv[2];
+        size_t parsed = 0;
+        try {
+            candidateThreshold = std::stod(arg, &parsed);
+        } catch (...) {
+            parsed = 0;
+        }
+
+        if (parsed == 0 || parsed != arg.size() || !(candidateThreshold >= 0.0 && candidateThreshold <= 1.0)) {
+            std::cerr << "Invalid candidate threshold: " << arg << " (expected a number in [0, 1])" << std::endl;
+            return -1;
+        }
+    }
+
     std::string inputImages = inputRoot + "images/";
     std::string inputLabels = inputRoot + "labels/";
     std::string groundTruthCsv = inputRoot + "ground_truth.csv";
+    std::string fullFrameCsv = inputRoot + "fullframe_detections.csv";
 
     std::string outputFolder = "data/output/images/";
     std::string outputCsv = "data/output/alldetections.csv";
+    std::string candidatesCsvPath = "data/output/candidates.csv";
 
     // Convert YOLO labels to CSV format if ground truth CSV does not exist
     if (!fs::exists(groundTruthCsv)) {
@@ -48,17 +68,73 @@ int main(int argc, char* argv[]) {
     std::ofstream csv(outputCsv);
     csv << "image,x,y,w,h\n";
 
+    // Open CSV file to save the candidate regions searched by the cascades
+    std::ofstream candidatesCsv(candidatesCsvPath);
+    candidatesCsv << "image,x,y,w,h\n";
+
     // Process each image: detect faces and save results
+    double searchedFraction = 0.0;
+    int processedImages = 0;
     for (const auto &file: imageFiles) {
-        processImage(file, outputFolder, frontalCascade, profileCascade, csv);
+        double fraction = processImage(file, outputFolder, frontalCascade, profileCascade, csv, candidatesCsv,
+                                       candidateThreshold);
+        // Negative means the image could not be loaded
+        if (fraction >= 0.0) {
+            searchedFraction += fraction;
+            processedImages++;
+        }
     }
 
     csv.close();
+    candidatesCsv.close();
     std::cout << "Face detection completed.\nResults in: " << outputFolder << " and " << outputCsv << "\n";
 
+    if (processedImages > 0) {
+        std::cout << "Average frame area searched: " << 100.0 * searchedFraction / processedImages << "%\n";
+    }
+
     // Evaluate detections against ground truth using IoU threshold
     std::string tpCsv = "data/detections.csv";
-    evaluateFaceDetection(outputCsv, groundTruthCsv, tpCsv, 0.5);
+    double recall = evaluateFaceDetection(outputCsv, groundTruthCsv, tpCsv, 0.5);
+
+    if (candidateThreshold == 0.0) {
+        // Keep the full-frame detections as the baseline for prefiltered runs
+        std::error_code ec;
+        fs::copy_file(outputCsv, fullFrameCsv, fs::copy_options::overwrite_existing, ec);
+        if (ec)
+            std::cerr << "Warning: could not save full-frame baseline " << fullFrameCsv << ": " << ec.message() << "\n";
+    } else {
+        // Ground truth faces outside every candidate region
+        evaluateCandidateCoverage(candidatesCsvPath, groundTruthCsv);
+
+        // Actual detection recall lost compared to scanning the full frame
+        if (fs::exists(fullFrameCsv)) {
+            std::cout << "Full-frame baseline: " << fullFrameCsv << "\n";
+
+            // A baseline from another image set or older parameters gives a wrong loss
+            std::unordered_set<std::string> baselineImages;
+            for (const auto &det: loadDetectionsFromCSV(fullFrameCsv))
+                baselineImages.insert(det.imageName);
+
+            int missingImages = 0;
+            std::unordered_set<std::string> checkedImages;
+            for (const auto &det: loadDetectionsFromCSV(outputCsv)) {
+                if (checkedImages.insert(det.imageName).second && !baselineImages.contains(det.imageName))
+                    missingImages++;
+            }
+
+            if (missingImages > 0) {
+                std::cerr << "Warning: " << missingImages << " image(s) with detections are missing from the "
+                        << "full-frame baseline, it may be stale: rerun with threshold 0\n";
+            }
+
+            double fullFrameRecall = evaluateFaceDetection(fullFrameCsv, groundTruthCsv, "", 0.5, false);
+            std::cout << "Full-frame recall:   " << fullFrameRecall << "\n";
+            std::cout << "Detection recall loss: " << fullFrameRecall - recall << "\n";
+        } else {
+            std::cout << "No full-frame baseline found: run once with threshold 0 to measure the detection recall loss\n";
+        }
+    }
 
     return 0;
 }